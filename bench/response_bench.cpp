@@ -0,0 +1,109 @@
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <time.h>
+#include <response/HttpResponse.hpp>
+#include <response/ResponseBuilder.hpp>
+#include <utils/HttpDate.hpp>
+#include <utils/string_utils.hpp>
+
+/**
+ * @file response_bench.cpp
+ * @brief Microbenchmark of response header serialization (`make bench`).
+ *
+ * Times, in ns per response, the path the server used before the Date
+ * cache (strftime + ostringstream per response) against the current one
+ * (cached Date, precomputed status line, one pre-sized buffer), and the
+ * preloaded error response.
+ */
+
+static const int	ROUNDS = 200000;
+
+static double	nowNs(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1e9 + ts.tv_nsec);
+}
+
+/// @brief Headers a static file response typically carries.
+static void	fillHeaders(HttpResponse& res)
+{
+	res.setStatusCode(ResponseStatus::OK);
+	res.setVersion("1.1");
+	res.addHeader("Server", "Webservinho/1.0");
+	res.addHeader("Connection", "keep-alive");
+	res.addHeader("Content-Type", "text/html");
+	res.addHeader("Last-Modified", "Sun, 18 Oct 2026 09:26:42 GMT");
+	res.addHeader("ETag", "\"ce8090-14-6ad490d2\"");
+	res.addHeader("Accept-Ranges", "bytes");
+}
+
+/// @brief Replaces the per-response headers (Date, Content-Length).
+static void	patchHeaders(HttpResponse& res, const std::string& date, const std::string& length)
+{
+	res.removeHeader("Date");
+	res.addHeader("Date", date);
+	res.removeHeader("Content-Length");
+	res.addHeader("Content-Length", length);
+}
+
+/// @brief The former serializer: Date formatted and headers streamed for every response.
+static std::string	legacyWriter(HttpResponse& res)
+{
+	std::ostringstream oss;
+	oss << "HTTP/" << res.getHttpVersion() << " " << res.getStatusCode() << " " << res.getReasonPhrase() << "\r\n";
+	const std::map<std::string, std::string>& headers = res.getHeaders();
+	for (std::map<std::string, std::string>::const_iterator it = headers.begin(); it != headers.end(); ++it)
+		oss << it->first << ": " << it->second << "\r\n";
+	oss << "\r\n";
+	return (oss.str());
+}
+
+static void	report(const char* name, double start, std::size_t bytes)
+{
+	double ns = (nowNs() - start) / ROUNDS;
+	std::cout << std::left << std::setw(28) << name << std::right << std::fixed << std::setprecision(1)
+		<< std::setw(10) << ns << " ns/response  (" << bytes / ROUNDS << " bytes)" << std::endl;
+}
+
+int	main(void)
+{
+	HttpResponse res;
+	std::size_t bytes = 0;
+
+	fillHeaders(res);
+	double start = nowNs();
+	for (int i = 0; i < ROUNDS; ++i)
+	{
+		patchHeaders(res, HttpDate::format(std::time(NULL)), toString(1024 + i % 7));
+		bytes += legacyWriter(res).size();
+	}
+	report("strftime + ostringstream", start, bytes);
+
+	bytes = 0;
+	start = nowNs();
+	for (int i = 0; i < ROUNDS; ++i)
+	{
+		HttpDate::tick(std::time(NULL));
+		patchHeaders(res, HttpDate::current(), sizeToString(1024 + i % 7));
+		bytes += ResponseBuilder::headerWriter(res).size();
+	}
+	report("cached Date + headerWriter", start, bytes);
+
+	ErrorResponse page;
+	ResponseBuilder::preloadErrorPage(ResponseStatus::NotFound, "", page);
+	HttpResponse error;
+	error.setStatusCode(ResponseStatus::NotFound);
+	error.addHeader("Connection", "keep-alive");
+	error.setErrorResponse(&page);
+	bytes = 0;
+	start = nowNs();
+	for (int i = 0; i < ROUNDS; ++i)
+	{
+		HttpDate::tick(std::time(NULL));
+		bytes += ResponseBuilder::responseWriter(error).size();
+	}
+	report("preloaded 404", start, bytes);
+	return (0);
+}
@@ -12,6 +12,8 @@
 class ConfigParser
 {
 	private:
+		static std::string				_configDir; // relative file paths in directives start here
+
 		static std::string				cleanConfigFile(std::ifstream& file);
 		static std::vector<std::string>	tokenize(std::istringstream& in);
 		static void						parseServerBlock(std::vector<std::string> const& tokens, std::size_t& i, Config& config);
@@ -22,6 +24,9 @@ class ConfigParser
 		static void						parseListenInterface(std::string rawListen, ServerConfig& server);
 		static void						parseClientBodySize(std::string bodySize, ServerConfig& server);
 		static RequestMethod::Method	parseMethod(std::string const& token);
+		static int						parseDuration(std::string const& token);
+		static std::size_t				parseSize(std::string const& token);
+		static std::string				resolvePath(std::string const& path);
 
 		ConfigParser(std::string file);
 		ConfigParser(ConfigParser const& src);
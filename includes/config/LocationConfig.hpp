@@ -7,6 +7,30 @@
 
 //webserv
 #include <request/RequestMethod.hpp>
+#include <dispatcher/CgiEnv.hpp>
+
+/// @brief Values of the `gzip_static` directive.
+struct GzipStatic
+{
+	enum mode
+	{
+		Off = 0, ///< Always serve the file itself.
+		On,      ///< Serve foo.br / foo.gz when the client accepts the coding.
+		Always   ///< As On, but foo.gz is served even without Accept-Encoding: gzip.
+	};
+};
+
+/// @brief Kinds of `expires` directive.
+struct Expires
+{
+	enum mode
+	{
+		Off = 0, ///< No Expires / max-age.
+		Ttl,     ///< max-age=N and Expires = now + N.
+		Epoch,   ///< no-cache and an Expires in 1970.
+		Max      ///< max-age of 10 years and an Expires in 2037.
+	};
+};
 
 class LocationConfig
 {
@@ -16,7 +40,18 @@ class LocationConfig
 		std::string							_root; //if empty, inherits
 		std::string							_indexFiles; // inherits if not set
 		bool								_autoindex; // inherits if not set
+		GzipStatic::mode					_gzipStatic; // serve precompressed .br/.gz sidecars, default: off
+		bool								_gzip; // compress responses on the fly, default: off
+		std::vector<std::string>			_gzipTypes; // MIME types compressed, text/html always included
+		std::size_t							_gzipMinLength; // smaller bodies are sent as they are, default: 20
+		int									_gzipCompLevel; // zlib level 1-9, default: 1
+		Expires::mode						_expires; // default: off
+		int									_expiresTtl; // seconds, for Expires::Ttl
+		std::string							_cacheControl; // extra Cache-Control directives, e.g. "public, no-transform"
+		bool								_immutable; // fingerprinted assets: one year max-age + immutable
+		std::string							_cacheHeaders; // Cache-Control / fixed Expires lines, built by buildCacheHeaders()
 		std::vector<RequestMethod::Method>	_methods; //doesn't inherit, default: GET
+		bool								_stubStatus; // serves the metrics instead of files, default: off
 
 		// Optional features
 		std::pair<int, std::string>			_return; // e.g. {301, "http://www.example.com/moved/her"} //only one redirect per location
@@ -24,6 +59,27 @@ class LocationConfig
 		bool								_uploadEnabled; //default: "off"
 		std::string							_cgiPath; // Base directory for CGI scripts
 		std::map<std::string, std::string>	_cgiExtension; // e.g. {".py": "/usr/bin/python3"}
+		std::map<std::string, std::string>	_cgiWorker; // extension -> loader run by persistent interpreters
+		std::size_t							_cgiWorkerProcesses; // interpreters per worker pool, default: 2
+		std::string							_fastCgiPass; // e.g. "unix:/run/php/php-fpm.sock" or "127.0.0.1:9000"
+		int									_fastCgiConnectTimeout; // seconds, default: 5
+		int									_fastCgiReadTimeout; // seconds, default: 30
+		std::size_t							_fastCgiKeepalive; // kept-alive backend connections, default: 4
+		std::size_t							_cgiMaxConcurrency; // running CGI processes, default: 0 (unlimited)
+		std::size_t							_cgiQueueSize; // requests waiting for a CGI slot, default: 32
+		std::size_t							_cgiCacheSize; // bytes of cached CGI responses, default: 0 (off)
+		int									_cgiCacheValid; // seconds, when the script sends no freshness headers, default: 0
+		std::vector<std::string>			_cgiCacheKeyHeaders; // request headers added to the cache key
+		bool								_cgiCacheLock; // collapse identical CGI requests in flight, default: off
+		int									_cgiCacheLockTimeout; // seconds a collapsed request waits, default: 5
+		long								_cgiRlimitCpu; // CPU seconds per CGI process, default: -1 (inherit)
+		long								_cgiRlimitAs; // address space bytes per CGI process, default: -1 (inherit)
+		long								_cgiRlimitNofile; // open files per CGI process, default: -1 (inherit)
+		int									_cgiNice; // scheduling priority of CGI processes
+		bool								_hasCgiNice;
+		std::string							_cgiCgroup; // cgroup v2 directory CGI processes are moved into
+		std::size_t							_cgiStderrLimit; // stderr bytes logged per CGI request, default: 64k
+		CgiEnv								_cgiEnvTemplate; // static CGI variables, built once the server block is parsed
 
 		// Flags
 		bool								_hasRoot;
@@ -41,12 +97,45 @@ class LocationConfig
 		std::string const&					getRoot(void) const;
 		std::string const&					getIndex(void) const;
 		bool								getAutoindex(void) const;
+		GzipStatic::mode					getGzipStatic(void) const;
+		bool								getGzip(void) const;
+		std::vector<std::string> const&		getGzipTypes(void) const;
+		std::size_t							getGzipMinLength(void) const;
+		int									getGzipCompLevel(void) const;
+		bool								gzipsType(std::string const& contentType) const;
+		Expires::mode						getExpires(void) const;
+		int									getExpiresTtl(void) const;
+		std::string const&					getCacheControl(void) const;
+		bool								getImmutable(void) const;
+		std::string const&					getCacheHeaders(void) const;
 		std::vector<RequestMethod::Method> const&	getMethods(void) const;
+		bool								getStubStatus(void) const;
 		std::pair<int, std::string> const&	getReturn(void) const;
 		std::string const&					getUploadPath(void) const;
 		bool								getUploadEnabled(void) const;
 		std::string const&					getCgiPath(void) const;
 		std::map<std::string, std::string> const&	getCgiExtension(void) const; //double check
+		std::map<std::string, std::string> const&	getCgiWorker(void) const;
+		std::size_t							getCgiWorkerProcesses(void) const;
+		std::string const&					getFastCgiPass(void) const;
+		int									getFastCgiConnectTimeout(void) const;
+		int									getFastCgiReadTimeout(void) const;
+		std::size_t							getFastCgiKeepalive(void) const;
+		std::size_t							getCgiMaxConcurrency(void) const;
+		std::size_t							getCgiQueueSize(void) const;
+		std::size_t							getCgiCacheSize(void) const;
+		int									getCgiCacheValid(void) const;
+		std::vector<std::string> const&		getCgiCacheKeyHeaders(void) const;
+		bool								getCgiCacheLock(void) const;
+		int									getCgiCacheLockTimeout(void) const;
+		long								getCgiRlimitCpu(void) const;
+		long								getCgiRlimitAs(void) const;
+		long								getCgiRlimitNofile(void) const;
+		int									getCgiNice(void) const;
+		bool								getHasCgiNice(void) const;
+		std::string const&					getCgiCgroup(void) const;
+		std::size_t							getCgiStderrLimit(void) const;
+		CgiEnv const&						getCgiEnvTemplate(void) const;
 		bool								getHasRoot(void) const;
 		bool								getHasIndexFiles(void) const;
 		bool								getHasAutoIndex(void) const;
@@ -55,12 +144,42 @@ class LocationConfig
 		void								setRoot(std::string);
 		void								setIndex(std::string);
 		void								setAutoindex(bool);
+		void								setGzipStatic(GzipStatic::mode);
+		void								setGzip(bool);
+		void								setGzipTypes(std::vector<std::string>);
+		void								setGzipMinLength(std::size_t);
+		void								setGzipCompLevel(int);
+		void								setExpires(Expires::mode, int);
+		void								setCacheControl(std::string);
+		void								setImmutable(bool);
+		void								buildCacheHeaders(void);
 		void								setMethods(std::vector<RequestMethod::Method>);
+		void								setStubStatus(bool);
 		void								setReturn(std::pair<int, std::string>);
 		void								setUploadPath(std::string);
 		void								setUploadEnabled(bool);
 		void								setCgiPath(std::string);
 		void								addCgiExtension(std::string const&, std::string const&);
+		void								addCgiWorker(std::string const&, std::string const&);
+		void								setCgiWorkerProcesses(std::size_t);
+		void								setFastCgiPass(std::string);
+		void								setFastCgiConnectTimeout(int);
+		void								setFastCgiReadTimeout(int);
+		void								setFastCgiKeepalive(std::size_t);
+		void								setCgiMaxConcurrency(std::size_t);
+		void								setCgiQueueSize(std::size_t);
+		void								setCgiCacheSize(std::size_t);
+		void								setCgiCacheValid(int);
+		void								setCgiCacheKeyHeaders(std::vector<std::string>);
+		void								setCgiCacheLock(bool);
+		void								setCgiCacheLockTimeout(int);
+		void								setCgiRlimitCpu(long);
+		void								setCgiRlimitAs(long);
+		void								setCgiRlimitNofile(long);
+		void								setCgiNice(int);
+		void								setCgiCgroup(std::string);
+		void								setCgiStderrLimit(std::size_t);
+		void								setCgiEnvTemplate(CgiEnv const&);
 };
 
 #endif //LOCATIONCONFIG_HPP
\ No newline at end of file
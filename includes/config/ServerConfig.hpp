@@ -8,6 +8,8 @@
 //webserv
 #include <config/LocationConfig.hpp>
 #include <request/RequestMethod.hpp>
+#include <response/HttpResponse.hpp>
+#include <utils/AccessLog.hpp>
 
 class ServerConfig
 {
@@ -16,9 +18,12 @@ class ServerConfig
 		std::string											_root; //not default and not optional //don't allow more than on in the block
 		std::size_t											_clientMaxBodysize; //in bytes //default: 1mb //if set to 0, disconsider the limit
 		std::map<int, std::string>							_errorPage; // e.g. {404: "errors/404.html"} //default: 404
+		std::map<int, ErrorResponse>						_errorResponses; // serialized 4xx/5xx responses, built by buildErrorResponses()
 		std::string											_indexFile; // e.g. "index.html" //not default and optional
 		bool												_autoindex; // default: "off"
 		std::vector<LocationConfig>							_locations; //not default and not optional
+		AccessLogConfig										_accessLog; // default: off
+		bool												_serverTiming; // Server-Timing header with the phase durations, default: off
 
 		ServerConfig&										operator=(ServerConfig const& rhs);
 
@@ -32,8 +37,11 @@ class ServerConfig
 		std::string const&									getRoot(void) const;
 		std::size_t const&									getClientMaxBodySize(void) const;
 		std::map<int, std::string> const&					getErrorPage(void) const;
+		const ErrorResponse*								getErrorResponse(int code) const;
 		bool												getAutoindex(void) const;
 		std::vector<LocationConfig> const&					getLocationConfig(void) const;
+		AccessLogConfig const&								getAccessLog(void) const;
+		bool												getServerTiming(void) const;
 		const LocationConfig&								matchLocation(const std::string& uri) const;
 
 		//mutators
@@ -44,7 +52,11 @@ class ServerConfig
 		void												setIndexFile(std::string);
 		//void												setErrorPage(std::map<int, std::string>);
 		void												setAutoindex(bool);
+		void												setAccessLog(AccessLogConfig const&);
+		void												setServerTiming(bool);
 		void												addLocation(LocationConfig& location);
+		void												buildCgiEnvTemplates(void);
+		void												buildErrorResponses(void);
 };
 
 #endif //SERVERCONFIG_HPP
\ No newline at end of file
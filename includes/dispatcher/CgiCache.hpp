@@ -0,0 +1,70 @@
+#ifndef CGI_CACHE_HPP
+# define CGI_CACHE_HPP
+
+#include <string>
+#include <list>
+#include <map>
+#include <ctime>
+
+//webserv
+#include <request/HttpRequest.hpp>
+#include <response/HttpResponse.hpp>
+#include <config/LocationConfig.hpp>
+
+/// @brief A CGI response as parsed by ResponseBuilder::handleCgiOutput().
+struct CgiCacheEntry
+{
+	std::string							key;
+	ResponseStatus::code				status;
+	std::map<std::string, std::string>	headers;
+	std::string							body;
+	std::time_t							expires;
+	std::size_t							size; // bytes charged to the zone
+};
+
+/// @brief Cached responses of one location, most recently used first.
+struct CgiCacheZone
+{
+	std::list<CgiCacheEntry>											lru;
+	std::map<std::string, std::list<CgiCacheEntry>::iterator>		index;
+	std::size_t															bytes;
+
+	CgiCacheZone(void) : bytes(0) {}
+};
+
+/**
+ * @class CgiCache
+ * @brief In-memory micro-cache of CGI responses (`cgi_cache`).
+ *
+ * Responses are keyed by method, URI, query string and the request headers
+ * listed in `cgi_cache_key_headers`. Their lifetime comes from the script's
+ * X-Accel-Expires, Cache-Control or Expires headers, falling back to
+ * `cgi_cache_valid`. Each location has its own size budget; the least
+ * recently used entries are evicted first.
+ *
+ * A hit is answered by the Dispatcher without starting the script.
+ */
+class CgiCache
+{
+	private:
+		std::map<LocationConfig const*, CgiCacheZone>	_zones;
+
+		CgiCache(void);
+		CgiCache(const CgiCache&);
+		CgiCache& operator=(const CgiCache&);
+
+		void				erase(CgiCacheZone& zone, std::list<CgiCacheEntry>::iterator it);
+		static std::time_t	freshUntil(const HttpResponse& response, int defaultTtl, std::time_t now);
+
+	public:
+		~CgiCache(void);
+
+		static CgiCache&	instance(void);
+		static std::string	makeKey(const HttpRequest& request, const LocationConfig& location);
+		static bool			isShareable(const HttpResponse& response);
+
+		bool	lookup(const LocationConfig& location, const std::string& key, HttpResponse& response);
+		void	store(const LocationConfig& location, const std::string& key, HttpResponse& response);
+};
+
+#endif // CGI_CACHE_HPP
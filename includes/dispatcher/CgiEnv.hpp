@@ -0,0 +1,37 @@
+#ifndef CGI_ENV_HPP
+# define CGI_ENV_HPP
+
+#include <string>
+
+/**
+ * @class CgiEnv
+ * @brief CGI environment stored as one contiguous block of "NAME=value\0" entries.
+ *
+ * This is already the wire format of a CgiSpawner request, so a request's
+ * environment is copied into the spawn message in one piece and the helper
+ * points envp straight into it. Static variables are built once per
+ * location (see CgiHandler::envTemplate()); per request only the dynamic
+ * entries are appended to a copy of that template.
+ */
+class CgiEnv
+{
+	private:
+		std::string		_arena;
+		unsigned int	_count;
+
+	public:
+		CgiEnv(void);
+		CgiEnv(const CgiEnv& src);
+		CgiEnv& operator=(const CgiEnv& rhs);
+		~CgiEnv(void);
+
+		void				reserve(std::size_t bytes);
+		void				add(const char* name, const std::string& value);
+		void				addHeader(const std::string& name, const std::string& value);
+
+		const std::string&	data(void) const;
+		unsigned int		count(void) const;
+		bool				empty(void) const;
+};
+
+#endif // CGI_ENV_HPP
@@ -10,22 +10,48 @@
 //webserv
 #include <request/HttpRequest.hpp>
 #include <response/HttpResponse.hpp>
-#include <init/ClientConnection.hpp>
+#include <dispatcher/CgiEnv.hpp>
+#include <dispatcher/CgiSpawner.hpp>
+
+class LocationConfig;
+class ServerConfig;
+
+/// @brief Everything needed to start a CGI, captured before the request is reset.
+struct CgiJob
+{
+	std::string					path;     // script a executar
+	std::string					cwd;      // diretório do script
+	std::vector<std::string>	argv;
+	CgiEnv						env;      // template + variáveis do request, contíguo
+	CgiLimits					limits;   // rlimits, nice e cgroup da location
+	bool						hasBody;  // mantém stdin aberto para o corpo
+	bool						nph;      // saída bruta (nph-*), enviada sem parsing
+};
 
 struct CgiProcess
 {
 	pid_t		pid;
 	int			in_fd;      // stdin do CGI (-1 se não usado)
 	int			out_fd;     // stdout do CGI
-	int			err_fd;     // stderr (-1 se não usado)
+	int			err_fd;     // stderr, lido para o log (-1 quando fechado)
+	int			pid_fd;     // pidfd no poll (-1 sem suporte: reap por timer)
+	bool		exited;     // processo já colhido via waitpid
+	int			status;     // status do waitpid
 	std::string	hdrBuf;   // cabeçalhos brutos do CGI
 	std::string	outBuf;   // corpo da resposta
 	bool		headersParsed;
-	bool		finished;
+	bool		finished;   // EOF no stdout
 	bool		chunked;
 	time_t		startAt;
 	time_t		deadline;
 	int			client_fd;         // fd do cliente associado
+	LocationConfig const*	location; // slot de concorrência ocupado
+	unsigned long	requestId;  // id do request, para os logs
+	std::string	errLine;    // linha incompleta do stderr
+	size_t		errLogged;  // bytes de stderr já logados (cgi_stderr_limit)
+	size_t		errDropped; // linhas descartadas por limite ou taxa
+	time_t		errWindow;  // segundo corrente do limite de taxa
+	int			errLines;   // linhas logadas nesse segundo
 };
 
 class CgiHandler
@@ -41,15 +67,21 @@ class CgiHandler
 		// modo síncrono (para testes ou fallback)
 		static void			handle(HttpRequest& request, HttpResponse& response);
 
-		// modo assíncrono: cria processo CGI e retorna estrutura com FDs
-		static CgiProcess	startAsync(HttpRequest& request, int clientFd);
+		// modo assíncrono: prepara o job (antes do reset do request) e cria o processo
+		static CgiJob		prepare(HttpRequest& request, const LocationConfig& location);
+		static CgiProcess	launch(const CgiJob& job, int clientFd);
 
 		// helpers
 		static std::string	extractScriptName(const std::string& resolvedPath);
 		static std::string	extractPathInfo(const std::string& uri, const std::string& scriptName);
 
-		static char**		buildEnvp(HttpRequest& request);
-		static void			freeEnvp(char** envp);
+		static std::string	interpreterFor(const LocationConfig& location, const std::string& path);
+		static std::string	workerFor(const LocationConfig& location, const std::string& path);
+		static bool			isNph(const std::string& path);
+		static CgiLimits	limitsFor(const LocationConfig& location);
+
+		static CgiEnv		envTemplate(const LocationConfig& location, const ServerConfig& server);
+		static CgiEnv		buildEnv(HttpRequest& request, const LocationConfig& location);
 		static void			setupRedirection(int* stdinPipe, int* stdoutPipe);
 };
 
@@ -0,0 +1,111 @@
+#ifndef CGI_SPAWNER_HPP
+# define CGI_SPAWNER_HPP
+
+#include <deque>
+#include <string>
+#include <vector>
+#include <sys/types.h>
+
+//webserv
+#include <dispatcher/CgiEnv.hpp>
+
+/// @brief Per-location limits applied to a script between clone and exec (-1 = inherit).
+struct CgiLimits
+{
+	long		cpu;      // RLIMIT_CPU, seconds
+	long		as;       // RLIMIT_AS, bytes
+	long		nofile;   // RLIMIT_NOFILE
+	int			nice;
+	bool		hasNice;
+	std::string	cgroup;   // cgroup v2 directory ("" = keep the server's)
+
+	CgiLimits(void) : cpu(-1), as(-1), nofile(-1), nice(0), hasNice(false) {}
+};
+
+/// @brief Who waits for a spawn answer: a CGI client, or a cgi_worker connection of the FastCgiPool.
+struct SpawnTicket
+{
+	enum Owner { Cgi, Worker };
+
+	Owner	owner;
+	int		fd;       // client socket (Cgi) or worker socket pair (Worker)
+
+	SpawnTicket(Owner o, int f) : owner(o), fd(f) {}
+};
+
+/// @brief Outcome of one spawn request: the script pid, or -1 and an errno value.
+struct SpawnReply
+{
+	SpawnTicket	ticket;
+	pid_t		pid;
+	int			error;
+
+	SpawnReply(const SpawnTicket& t, pid_t p, int e) : ticket(t), pid(p), error(e) {}
+};
+
+/**
+ * @class CgiSpawner
+ * @brief Small helper process that starts CGI scripts on behalf of the server.
+ *
+ * Forked once at startup, while the server is still small, so the main
+ * process never has to fork() with its full address space. The server sends
+ * each spawn request (path, working directory, argv, envp) over a Unix
+ * socket, with the script's stdin/stdout (and optionally stderr) pipe ends
+ * attached as SCM_RIGHTS.
+ *
+ * The helper creates the script with CLONE_PARENT, so CGI processes are
+ * children of the server itself: waitpid() and SIGCHLD work as before.
+ * Resource limits, nice value and cgroup are applied in the child right
+ * before execve(), so they never touch the server or the helper.
+ *
+ * The server never waits for the helper: request() only sends, and the
+ * answers (in request order on the SEQPACKET socket) are read by collect()
+ * when socket() polls readable. Each request carries a SpawnTicket telling
+ * whom its answer is for. A request unanswered after SPAWN_REPLY_TIMEOUT_MS
+ * is given up by expire(); like a cancelled one, its script is killed when
+ * the answer finally comes.
+ */
+class CgiSpawner
+{
+	private:
+		/// @brief A request sent to the helper and not answered yet.
+		struct Pending
+		{
+			SpawnTicket	ticket;
+			long		sentMs;
+			bool		dropped;  // cancelled or expired: kill the script on arrival
+
+			Pending(const SpawnTicket& t, long ms) : ticket(t), sentMs(ms), dropped(false) {}
+		};
+
+		static int					_sock;
+		static pid_t				_pid;
+		static std::deque<Pending>	_pending;
+		static std::vector<pid_t>	_orphans; // scripts nobody waits for, killed and not reaped yet
+
+		CgiSpawner(void);
+		CgiSpawner(const CgiSpawner&);
+		CgiSpawner& operator=(const CgiSpawner&);
+
+		static void		serve(int sock);
+		static pid_t	launch(char* msg, size_t len, int inFd, int outFd, int errFd);
+		static void		applyLimits(const long* limits, int procsFd);
+		static void		helperGone(std::vector<SpawnReply>& replies);
+		static void		reapOrphans(void);
+
+	public:
+		static void		start(void);
+		static void		stop(void);
+		static bool		isRunning(void);
+		static int		socket(void);
+		static bool		hasPending(void);
+		static bool		request(const std::string& path, const std::string& cwd,
+							const std::vector<std::string>& argv,
+							const CgiEnv& env, const CgiLimits& limits, const SpawnTicket& ticket,
+							int inFd, int outFd, int errFd = -1);
+		static void		collect(std::vector<SpawnReply>& replies);
+		static void		expire(long nowMs, std::vector<SpawnReply>& replies);
+		static void		cancel(const SpawnTicket& ticket);
+};
+
+#endif // CGI_SPAWNER_HPP
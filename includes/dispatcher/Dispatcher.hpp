@@ -15,6 +15,7 @@ class Dispatcher
 
 	public:
 		static void	dispatch(ClientConnection& client);
+		static bool	shouldStreamBody(ClientConnection& client);
 };
 
 #endif //DISPATCHER_HPP
\ No newline at end of file
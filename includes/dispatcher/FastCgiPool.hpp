@@ -0,0 +1,148 @@
+#ifndef FAST_CGI_POOL_HPP
+# define FAST_CGI_POOL_HPP
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <map>
+#include <ctime>
+#include <sys/socket.h>
+
+//webserv
+#include <config/LocationConfig.hpp>
+#include <response/ResponseStatus.hpp>
+#include <dispatcher/CgiEnv.hpp>
+#include <dispatcher/CgiSpawner.hpp>
+
+/**
+ * @struct FastCgiResult
+ * @brief Outcome of a FastCGI request, handed back to the event loop.
+ *
+ * When `status` is OK, `output` holds the CGI-style response (headers + body)
+ * collected from the FCGI_STDOUT stream.
+ */
+struct FastCgiResult
+{
+	int						clientFd;
+	ResponseStatus::code	status;
+	std::string				output;
+};
+
+/// @brief A request waiting for (or assigned to) a backend connection.
+struct FastCgiRequest
+{
+	int			clientFd;   // -1 once the client is gone or the request timed out
+	std::string	params;     // encoded FCGI_PARAMS payload
+	std::string	body;       // FCGI_STDIN payload
+	std::string	output;     // FCGI_STDOUT collected so far
+	std::time_t	deadline;
+	bool		idempotent; // GET or HEAD: safe to replay once the backend may have seen it
+	bool		retried;    // already replayed once after a dead kept-alive connection
+	unsigned long long	streamStart; // connection bytes sent before its first record
+	bool		aborted;
+};
+
+/// @brief One kept-alive connection to a FastCGI application server.
+struct FastCgiConnection
+{
+	int										fd;
+	std::string								backend;
+	bool									connected;
+	bool									multiplexed; // FCGI_MPXS_CONNS reported by the backend
+	std::size_t								maxRequests;
+	std::string								outBuf;
+	std::size_t								outSent;
+	unsigned long long						sentTotal; // bytes sent since the connection opened
+	std::string								inBuf;
+	std::map<unsigned short, FastCgiRequest>	requests;
+	unsigned short							nextId;
+	std::time_t								connectDeadline;
+	pid_t									pid; // persistent interpreter on the other end, 0 until spawned, -1 for sockets
+};
+
+/// @brief Settings and admission queue shared by all connections to one address.
+struct FastCgiBackend
+{
+	std::string					address;
+	std::vector<std::string>	command; // cgi_worker: interpreter + loader, spawned instead of connecting
+	CgiLimits					limits;
+	int							connectTimeout;
+	int							readTimeout;
+	std::size_t					maxConns;
+	bool						resolved;
+	struct sockaddr_storage		addr;
+	socklen_t					addrLen;
+	std::deque<FastCgiRequest>	queue;
+};
+
+/**
+ * @class FastCgiPool
+ * @brief Client side of the FastCGI protocol with persistent backend connections.
+ *
+ * Requests are framed as BEGIN_REQUEST/PARAMS/STDIN records and sent over
+ * non-blocking connections that are kept alive (FCGI_KEEP_CONN) and reused.
+ * Each new connection asks the backend for FCGI_MPXS_CONNS/FCGI_MAX_REQS;
+ * backends that accept multiplexing get several requests per connection,
+ * others get one at a time. Requests over capacity wait in a FIFO per backend.
+ *
+ * Persistent interpreters (`cgi_worker`) are backends too: instead of
+ * connecting, the pool spawns `interpreter loader` with one end of a socket
+ * pair as its stdin/stdout, and the loader answers FastCGI records on it.
+ * Such a worker runs one request at a time; the pool kills and reaps it when
+ * its connection is dropped, and spawns a new one on demand.
+ *
+ * The pool never touches poll() itself: the WebServer asks which descriptors
+ * it owns, which events they need, and feeds readiness back through
+ * handleEvent(). Completed or failed requests are returned as FastCgiResult.
+ */
+class FastCgiPool
+{
+	private:
+		std::map<int, FastCgiConnection>		_conns;
+		std::map<std::string, FastCgiBackend>	_backends;
+		std::vector<int>						_opened;
+		std::vector<int>						_closed;
+		std::vector<pid_t>						_exiting; // killed workers not reaped yet
+
+		FastCgiPool(const FastCgiPool&);
+		FastCgiPool& operator=(const FastCgiPool&);
+
+		FastCgiBackend&	backendFor(const LocationConfig& loc, const std::string& worker);
+		bool			resolve(FastCgiBackend& backend);
+		int				openConnection(FastCgiBackend& backend);
+		int				spawnWorker(FastCgiBackend& backend);
+		void			reapWorkers(void);
+		void			closeConnection(int fd);
+		void			failConnection(int fd, std::vector<FastCgiResult>& results);
+		void			drainQueue(FastCgiBackend& backend, std::vector<FastCgiResult>& results);
+		void			assign(FastCgiConnection& conn, FastCgiRequest& req);
+		void			flush(FastCgiConnection& conn);
+		void			parseRecords(FastCgiConnection& conn, std::vector<FastCgiResult>& results);
+		void			parseValues(FastCgiConnection& conn, const std::string& content);
+
+		static void		appendRecord(std::string& out, unsigned char type, unsigned short id, const std::string& content);
+		static void		appendStream(std::string& out, unsigned char type, unsigned short id, const std::string& content);
+		static void		appendLength(std::string& out, std::size_t len);
+
+	public:
+		FastCgiPool(void);
+		~FastCgiPool(void);
+
+		static std::string	encodeParams(const CgiEnv& env);
+
+		void	submit(const LocationConfig& loc, const std::string& worker, int clientFd,
+					const std::string& params, const std::string& body, bool idempotent,
+					std::vector<FastCgiResult>& results);
+		void	handleEvent(int fd, short revents, std::vector<FastCgiResult>& results);
+		void	sweepTimeouts(std::time_t now, std::vector<FastCgiResult>& results);
+		void	cancel(int clientFd);
+		void	workerSpawned(const SpawnReply& reply, std::vector<FastCgiResult>& results);
+
+		bool	owns(int fd) const;
+		short	pollEvents(int fd) const;
+		bool	hasActivity(void) const;
+		void	takeOpened(std::vector<int>& fds);
+		void	takeClosed(std::vector<int>& fds);
+};
+
+#endif // FAST_CGI_POOL_HPP
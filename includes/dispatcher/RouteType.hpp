@@ -12,11 +12,13 @@
  * Route types:
  * - StaticPage: Serves a static file or HTML page from disk.
  * - CGI: Executes a CGI script and returns its generated output.
+ * - FastCGI: Forwards the request to a FastCGI backend (`fastcgi_pass`).
  * - AutoIndex: Generates a dynamic directory listing for a folder.
  * - Upload: Handles file upload requests via POST or PUT methods.
  * - Redirect: Sends an HTTP redirection response (3xx) to the client.
  * - Delete: Processes DELETE requests to remove existing resources.
  * - Error: Represents an invalid, forbidden, or not found route.
+ * - Status: Serves the server's metrics (`stub_status`).
  */
 struct RouteType
 {
@@ -29,7 +31,10 @@ struct RouteType
 		Upload,         ///< Handles file upload requests.
 		Redirect,       ///< Issues an HTTP redirection response.
 		Delete,         ///< Processes HTTP DELETE requests to remove resources.
-		Error           ///< Represents an error or invalid route configuration.
+		Error,          ///< Represents an error or invalid route configuration.
+		FastCGI,        ///< Forwards the request to a FastCGI application server.
+		Status,         ///< Serves the metrics in Prometheus text format.
+		Count           ///< Number of route types (not a route).
 	};
 };
 
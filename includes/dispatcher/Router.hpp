@@ -18,12 +18,14 @@ class Router
 		static bool	isUpload(HttpRequest& req, HttpResponse& res, ServerConfig const& config);
 		static bool	isStaticFile(const std::string& index, HttpRequest& req, HttpResponse& res);
 		static bool	isCgi(const LocationConfig& loc, HttpRequest& req, HttpResponse& res);
+		static bool	isFastCgi(const LocationConfig& loc, HttpRequest& req);
 		static bool isAutoIndex(const std::string& index, HttpRequest& req, ServerConfig const& config);
 		static bool	hasCgiExtension(const LocationConfig& loc, const std::string& path);
 		static bool	isRedirect(HttpRequest& req, HttpResponse& res, ServerConfig const& config);
 
 	public:
 		static void	resolve(HttpRequest& req, HttpResponse& res, ServerConfig const& config);
+		static bool	matchesCgi(HttpRequest& req, ServerConfig const& config);
 };
 
 #endif //ROUTER_HPP
\ No newline at end of file
@@ -0,0 +1,50 @@
+#ifndef STAT_CACHE_HPP
+# define STAT_CACHE_HPP
+
+#include <string>
+#include <map>
+#include <ctime>
+#include <sys/stat.h>
+
+/// @brief Seconds a stat() result is reused.
+#define STAT_CACHE_VALID 1
+/// @brief Paths remembered at most; expired entries are swept when it is reached.
+#define STAT_CACHE_MAX 4096
+
+/// @brief Outcome of one stat() call.
+struct StatCacheEntry
+{
+	bool		found;
+	struct stat	st;
+	std::time_t	checked;
+};
+
+/**
+ * @class StatCache
+ * @brief Short-lived cache of stat() results for static files.
+ *
+ * Every static request stats its file, and with `gzip_static` also the
+ * .br/.gz sidecars next to it, most of which do not exist. Results, misses
+ * included, are reused for STAT_CACHE_VALID seconds, so a busy path costs
+ * one stat() per second instead of one per request. Changes on disk show up
+ * once the entry expires.
+ */
+class StatCache
+{
+	private:
+		std::map<std::string, StatCacheEntry>	_entries;
+
+		StatCache(void);
+		StatCache(const StatCache&);
+		StatCache& operator=(const StatCache&);
+
+	public:
+		~StatCache(void);
+
+		static StatCache&	instance(void);
+
+		bool	lookup(const std::string& path, struct stat& st);
+		void	clear(void);
+};
+
+#endif // STAT_CACHE_HPP
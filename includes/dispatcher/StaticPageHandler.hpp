@@ -2,10 +2,17 @@
 # define STATIC_PAGE_HANDLER_HPP
 
 #include <string>
+#include <vector>
+#include <utility>
+#include <sys/stat.h>
 
 //webserv
 #include <request/HttpRequest.hpp>
 #include <response/HttpResponse.hpp>
+#include <config/LocationConfig.hpp>
+
+/// @brief Most ranges honoured in one request; longer Range lists are ignored (full 200).
+#define MAX_BYTE_RANGES 32
 
 class StaticPageHandler
 {
@@ -16,9 +23,19 @@ class StaticPageHandler
 		StaticPageHandler(const StaticPageHandler& rhs); //blocked
 
 		static const std::string	detectMimeType(const std::string& resolvedPath);
+		static std::string			makeETag(const struct stat& st);
+		static bool					etagListMatches(const std::string& list, const std::string& etag, bool weak);
+		static ResponseStatus::code	checkPreconditions(HttpRequest& req, const struct stat& st,
+										const std::string& etag);
+		static bool					ifRangeAllows(HttpRequest& req, const struct stat& st, const std::string& etag);
+		static bool					parseRanges(const std::string& header, off_t size,
+										std::vector<std::pair<off_t, off_t> >& ranges);
+		static const std::string*	gzipFile(const std::string& path, const struct stat& st, int level, int fd);
+		static std::string			selectSidecar(HttpRequest& req, GzipStatic::mode mode, std::string& path,
+										struct stat& st, bool& vary);
 
 	public:
-		static void	handle(HttpRequest& req, HttpResponse& res);
+		static void	handle(HttpRequest& req, HttpResponse& res, const LocationConfig& location);
 };
 
 #endif //STATIC_PAGE_HANDLER_HPP
@@ -0,0 +1,14 @@
+#ifndef STATUS_HANDLER_HPP
+#define STATUS_HANDLER_HPP
+
+//webserv
+#include <request/HttpRequest.hpp>
+#include <response/HttpResponse.hpp>
+
+class StatusHandler
+{
+	public:
+		static void	handle(HttpRequest& req, HttpResponse& res);
+};
+
+#endif // STATUS_HANDLER_HPP
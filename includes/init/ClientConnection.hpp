@@ -2,14 +2,39 @@
 # define CLIENTCONNECTION_HPP
 
 #include <string>
+#include <vector>
 #include <ctime>
 #include <sys/types.h>
 
 //webserv
 #include <request/HttpRequest.hpp>
 #include <response/HttpResponse.hpp>
+#include <dispatcher/CgiHandler.hpp>
+#include <response/GzipStream.hpp>
+#include <utils/AccessLog.hpp>
+
+/// @brief Upper bound for one sendfile() call, so a large file does not monopolise the loop.
+#define FILE_SEND_MAX (256 * 1024)
 
 class ServerConfig;
+class LocationConfig;
+
+/// @brief CGI response spliced from the script's stdout straight to the socket.
+struct CgiStream
+{
+	bool		active;
+	bool		checked;  // header block already examined
+	bool		chunked;  // no Content-Length from the script: framed as chunked
+	bool		nph;      // nph- script: raw output, connection closes at EOF
+	bool		inChunk;  // an open chunk still needs its trailing CRLF
+	bool		done;     // last bytes queued, close the stream once sent
+	bool		discard;  // HEAD request: body drained from the pipe, never sent
+	bool		gzip;     // body read and compressed (ClientConnection::gzipStream()), sent chunked
+	std::size_t	left;     // bytes to splice for the current chunk / Content-Length
+
+	CgiStream(void) : active(false), checked(false), chunked(false), nph(false),
+		inChunk(false), done(false), discard(false), gzip(false), left(0) {}
+};
 
 class ClientConnection
 {
@@ -20,15 +45,35 @@ class ClientConnection
 		std::string			_responseBuffer;
 		size_t				_sentBytes;
 		bool				_keepAlive;
+		unsigned long		_requestId; // sequence number of the current request (logs)
+		bool				_headOnly; // current request is a HEAD: send headers, no body
+		bool				_acceptsGzip; // current request's Accept-Encoding allows gzip
+		GzipStream*			_gzip; // encoder of a compressed CGI stream, NULL if none
 		HttpRequest			_httpRequest;
 		HttpResponse		_httpResponse;
+		int					_fileFd; // file body sent after _responseBuffer, -1 if none
+		std::vector<FileRange>	_fileRanges; // parts of it still to send, front first
+		std::string			_remoteAddr; // peer IP address, "-" if unknown
+		AccessRecord		_access; // access log data of the current request
 
 		// CGI async
 		bool				_hasCgi;
 		int					_cgiFd; // read (STDOUT of CGI)
+		int					_cgiInFd; // write (STDIN of CGI)
 		pid_t				_cgiPid;
 		std::time_t			_cgiStart;
 		std::string			_cgiBuffer;
+		std::string			_cgiInput; // body bytes not yet written to the CGI
+		size_t				_cgiInputSent;
+		size_t				_cgiBodyRemaining; // body bytes still expected from the socket
+		bool				_fastCgi; // request handed to a FastCGI backend instead of a child
+		std::string			_cgiParams; // encoded FCGI_PARAMS for the backend
+		LocationConfig const*	_cgiLocation;
+		CgiJob				_cgiJob; // launch parameters while waiting for a CGI slot
+		long				_cgiQueuedAt; // monotonic ms when queued (for wait logging)
+		std::string			_cgiCacheKey; // cgi_cache key of the pending response, empty if not cacheable
+		std::string			_cgiWorker; // extension of the cgi_worker pool running the script, if any
+		CgiStream			_cgiStream; // zero-copy output state once headers are sent
 
 		ClientConnection&	operator=(ClientConnection const& rhs);
 
@@ -45,6 +90,10 @@ class ClientConnection
 		void				clearBuffer(void);
 		void				adoptFD(int fd);
 		void				setKeepAlive(bool keepAlive);
+		void				adoptFileBody(HttpResponse& response);
+		bool				hasFileBody(void) const;
+		bool				sendFileBody(void);
+		void				clearFileBody(void);
 
 		// Accessors
 		int const&			getFD(void) const;
@@ -53,8 +102,20 @@ class ClientConnection
 		std::string const&	getResponseBuffer(void) const;
 		ServerConfig const&	getServerConfig(void) const;
 		bool				getKeepAlive(void) const;
+		unsigned long		getRequestId(void) const;
+		void				setRequestId(unsigned long id);
+		bool				isHeadOnly(void) const;
+		void				setHeadOnly(bool headOnly);
+		bool				acceptsGzip(void) const;
+		void				setAcceptsGzip(bool accepts);
+		GzipStream*			gzipStream(void);
+		void				startGzip(int level);
+		void				endGzip(void);
 		void				setSentBytes(size_t bytes);
 		void				setResponseBuffer(const std::string& buffer);
+		AccessRecord&		accessRecord(void);
+		AccessRecord const&	accessRecord(void) const;
+		std::string const&	getRemoteAddr(void) const;
 
 		HttpRequest&		getRequest(void);
 		HttpResponse&		getResponse(void);
@@ -63,14 +124,35 @@ class ClientConnection
 		bool				hasCgi() const;
 		bool				isCgiActive() const;
 		int					getCgiFd() const;
+		int					getCgiInFd() const;
 		pid_t				getCgiPid() const;
 		std::time_t			getCgiStart() const;
 		std::string&		cgiBuffer();
+		std::string&		cgiInput();
+		size_t				getCgiInputSent() const;
+		size_t				getCgiBodyRemaining() const;
+		bool				hasPendingCgiInput() const;
+		bool				isFastCgi() const;
+		std::string&		cgiParams();
+		LocationConfig const*	getCgiLocation() const;
+		CgiJob&				cgiJob();
+		long				getCgiQueuedAt() const;
+		bool				isCgiQueued() const;
+		bool				isCgiSpawning() const;
+		std::string&		cgiCacheKey();
+		std::string&		cgiWorker();
+		CgiStream&			cgiStream();
 
 		void				setCgiActive(bool v);
 		void				setCgiFd(int fd);
+		void				setCgiInFd(int fd);
+		void				setCgiInputSent(size_t sent);
+		void				setCgiBodyRemaining(size_t remaining);
 		void				setCgiPid(pid_t pid);
 		void				setCgiStart(std::time_t t);
+		void				setFastCgi(bool v);
+		void				setCgiLocation(LocationConfig const* location);
+		void				setCgiQueuedAt(long ms);
 		void				clearCgi();
 };
 
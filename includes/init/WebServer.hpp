@@ -2,16 +2,39 @@
 # define WEBSERVER_HPP
 
 #include <vector>
+#include <deque>
 #include <map>
 
 //webserv
 #include <init/ServerSocket.hpp>
 #include <utils/Signals.hpp>
 #include <dispatcher/CgiHandler.hpp>
+#include <dispatcher/FastCgiPool.hpp>
 #include <config/ServerConfig.hpp>
 #include <config/Config.hpp>
 
 class ClientConnection;
+
+/// @brief CGI admission state of one location (cgi_max_concurrency / cgi_queue_size).
+struct CgiSlots
+{
+	size_t			running;
+	std::deque<int>	waiting; // client fds, FIFO
+
+	CgiSlots(void) : running(0) {}
+};
+
+/// @brief Identical CGI requests in flight (cgi_cache_lock): one runs, the others wait for its response.
+struct CgiFlight
+{
+	int					leader;  // client running the script, -1 until a waiter takes over
+	std::map<int, long>	waiters; // client fd -> monotonic ms deadline
+
+	CgiFlight(void) : leader(-1) {}
+};
+
+typedef std::pair<LocationConfig const*, std::string>	CgiFlightKey;
+
 class WebServer
 {
 	private:
@@ -20,17 +43,74 @@ class WebServer
 		std::vector<ServerSocket*>		_serverSocket; //ServerSocket					_serverSocket; //needs to be a vector
 		std::map<int, ClientConnection>	_clients; //can also hold fd set to -1
 		std::vector<struct pollfd>		_pollFDs;
+		bool							_pollRetired; // há entradas com fd -1 a remover
 
 		WebServer(WebServer const& src); //memmove?
 		WebServer&						operator=(WebServer const& rhs); //memmove?
 
 		std::map<int,int> _cgiFdToClientFd;
-		std::map<int, CgiProcess> _cgiMap;
+		std::map<int,int> _cgiInFdToClientFd; // CGI stdin pipe -> client fd
+		std::map<pid_t, CgiProcess> _cgiProcs; // tabela de processos CGI, por pid
+		std::map<int, pid_t> _pidFdToPid;      // pidfd -> pid
+		std::map<int, pid_t> _cgiErrFdToPid;   // stderr do CGI -> pid
+		std::map<int, CgiProcess> _cgiSpawning; // cliente -> pipes à espera do pid do spawner
+		std::map<LocationConfig const*, CgiSlots> _cgiSlots; // limite de CGI por location
+		std::map<CgiFlightKey, CgiFlight> _cgiFlights; // requisições CGI idênticas em andamento
+		FastCgiPool _fastCgi; // persistent connections to fastcgi_pass backends
+		long _slowestUs;            // chamada mais lenta da iteração atual (watchdog)
+		int _slowestFd;
+		const char* _slowestEvent;
 
 		void addCgiPollFd(int cgiFd);
+		void addCgiInPollFd(int cgiInFd);
 		void removeCgiPollFd(int cgiFd);
 		void handleCgiReadable(int pollIndex); // lê dados do CGI e finaliza resposta quando EOF
+		void handleCgiWritable(int pollIndex); // bombeia o corpo do request para o stdin do CGI
+		void closeCgiInput(ClientConnection& client);
+		void refreshCgiInput(ClientConnection& client);
+		bool spliceCgiInput(ClientConnection& client, size_t pollIndex); // socket -> stdin do CGI sem cópia
+		bool startCgiStream(ClientConnection& client); // cabeçalhos prontos: passa o corpo por splice()
+		void pumpCgiStream(ClientConnection& client, short pipeEvents);
+		void waitCgiStream(ClientConnection& client, bool socketFull);
+		void endCgiStream(ClientConnection& client, bool complete);
+		void watchCgiOutput(int cgiFd, bool watch); // pausa o stdout no poll (fd negativo)
+		void setPollEvents(int fd, short events);
+		void retirePollEntry(size_t index);    // fd -1 agora, removida depois do loop
+		void compactPollFDs(void);
+		size_t pollIndexOf(int fd);
 		void sweepCgiTimeouts();               // mata CGI estourado
+		void startCgi(ClientConnection& client);   // junta-se a um pedido idêntico ou admite
+		void admitCgi(ClientConnection& client);   // admite, enfileira ou recusa (503)
+		void launchCgi(ClientConnection& client);    // pede o processo ao spawner, sem esperar
+		void attachCgi(ClientConnection& client, pid_t pid); // spawner respondeu: registra pipes e pidfd
+		void dropCgiSpawn(ClientConnection& client); // cliente sumiu antes do pid chegar
+		void deliverSpawnReplies(std::vector<SpawnReply>& replies);
+		void drainCgiQueues(void);
+		void dequeueCgi(ClientConnection& client);
+		void failCgi(ClientConnection& client, ResponseStatus::code status);
+		void queueCgiResponse(ClientConnection& client);
+		void shareCgiResponse(ClientConnection& leader);
+		void leaveCgiFlight(ClientConnection& client);
+		void sweepCgiFlights(void);            // espera esgotada: roda o próprio CGI
+		void trackCgiProcess(ClientConnection& client, int errFd);
+		void handleCgiStderr(int errFd);       // stderr legível: linhas para o log
+		void drainCgiStderr(CgiProcess& proc, bool final);
+		void logCgiStderr(CgiProcess& proc);
+		void handleCgiExit(int pidFd);         // pidfd legível: colhe o processo
+		bool reapCgi(CgiProcess& proc);        // waitpid(WNOHANG), nunca bloqueia
+		ResponseStatus::code cgiExitStatus(const CgiProcess& proc); // 502/504 se morto por um limite
+		void finishCgi(ClientConnection& client);
+		void abandonCgi(pid_t pid);            // cliente sumiu: mata e colhe depois
+		void forgetCgi(pid_t pid);
+		void startFastCgi(ClientConnection& client);
+		void handleFastCgiEvent(int fd, short revents);
+		void deliverFastCgiResults(std::vector<FastCgiResult>& results);
+		void syncFastCgiPoll(void);            // espelha os sockets do pool em _pollFDs
+		void finishRequest(ClientConnection& client); // access_log e métricas, prepara o próximo pedido
+		const char* handlePollEvent(ssize_t i, int fd, short re); // trata um fd pronto, devolve o tipo de evento
+		long timeHandler(long startUs, int fd, const char* event);
+		void endIteration(long pollUs, long busyUs, int ready); // métricas do loop e watchdog
+		std::string describeFd(int fd, const char* event) const; // diagnóstico: cliente, rota, fase
 
 	public:
 		WebServer(Config const& config);
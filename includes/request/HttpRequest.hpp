@@ -4,6 +4,7 @@
 #include <string>
 #include <map>
 #include <vector>
+#include <sys/stat.h>
 
 //webserv
 #include <request/RequestMethod.hpp>
@@ -37,6 +38,8 @@ class HttpRequest
 		bool								_parsingChunkSize;
 		bool								_expectingChunkSeparator;
 		std::string							_resolvedPath;
+		struct stat							_fileStat; // stat of the resolved file, taken while routing
+		bool								_hasFileStat;
 
 	public:
 		HttpRequest();
@@ -61,6 +64,7 @@ class HttpRequest
 		void	setParsingChunkSize(bool value);
 		void	setExpectingChunkSeparator(bool value);
 		void	setResolvedPath(const std::string path);
+		void	setFileStat(const struct stat& st);
 		void	reset(void);
 
 		//getters
@@ -84,8 +88,11 @@ class HttpRequest
 		bool						isParsingChunkSize() const;
 		bool						isExpectingChunkSeparator() const;
 		const std::string			getResolvedPath(void) const;
+		bool						hasFileStat(void) const;
+		const struct stat&			getFileStat(void) const;
 
 		bool						hasHeader(const std::string& key) const;
+		bool						acceptsEncoding(const std::string& coding) const;
 		void						removeHeader(const std::string& key);
 };
 
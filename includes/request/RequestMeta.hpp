@@ -11,6 +11,7 @@ class RequestMeta
 		bool		_connectionClose;
 		bool		_expectContinue; //expect 100-continue //before send body
 		bool		_isRedirect;
+		bool		_cgiProbed; // early CGI routing already checked for this body
 		std::string	_host;
 
 		RequestMeta(const RequestMeta& rhs); //blocked
@@ -27,6 +28,7 @@ class RequestMeta
 		void	setExpectContinue(bool expect_continue);
 		void	setRedirect(bool redirect);
 		void	setHost(const std::string& host);
+		void	setCgiProbed(bool probed);
 		void	resetMeta(void);
 
 		//getters
@@ -36,6 +38,7 @@ class RequestMeta
 		bool		getExpectContinue(void) const;
 		bool		isRedirect(void) const;
 		std::string	getHost(void) const;
+		bool		isCgiProbed(void) const;
 };
 
 #endif //REQUEST_META_HPP
\ No newline at end of file
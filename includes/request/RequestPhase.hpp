@@ -0,0 +1,31 @@
+#ifndef REQUEST_PHASE_HPP
+#define REQUEST_PHASE_HPP
+
+/**
+ * @struct RequestPhase
+ * @brief Consecutive phases of serving one request, timed with the monotonic clock.
+ *
+ * Phases:
+ * - Parse: first byte received until the request is complete (until its
+ *   headers when the body is streamed to a CGI).
+ * - Route: Router::resolve.
+ * - Handle: the handler; for CGI / FastCGI, until the backend's response is parsed.
+ * - Serialize: response building, compression and header / body serialization.
+ * - Wait: until the first byte is sent.
+ * - Send: first byte sent until the last one.
+ */
+struct RequestPhase
+{
+	enum phase
+	{
+		Parse = 0,
+		Route,
+		Handle,
+		Serialize,
+		Wait,
+		Send,
+		Count
+	};
+};
+
+#endif // REQUEST_PHASE_HPP
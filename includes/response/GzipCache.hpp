@@ -0,0 +1,49 @@
+#ifndef GZIP_CACHE_HPP
+# define GZIP_CACHE_HPP
+
+#include <string>
+#include <list>
+#include <map>
+
+/// @brief Bytes of compressed static files kept in memory.
+#define GZIP_CACHE_MAX (16 * 1024 * 1024)
+/// @brief Largest static file compressed on the fly; bigger ones are sent as they are.
+#define GZIP_CACHE_ENTRY_MAX (1024 * 1024)
+
+/// @brief Compressed copy of one version of a file.
+struct GzipCacheEntry
+{
+	std::string	key;
+	std::string	data;
+};
+
+/**
+ * @class GzipCache
+ * @brief Memoized `gzip` output of static files.
+ *
+ * Keys name the file version (path, inode, size, mtime), the coding and
+ * the compression level, so a file is compressed once per version and an
+ * edited file simply misses. Least recently used entries are evicted once
+ * GZIP_CACHE_MAX bytes are held; outdated versions age out that way.
+ */
+class GzipCache
+{
+	private:
+		std::list<GzipCacheEntry>									_lru;
+		std::map<std::string, std::list<GzipCacheEntry>::iterator>	_index;
+		std::size_t													_bytes;
+
+		GzipCache(void);
+		GzipCache(const GzipCache&);
+		GzipCache& operator=(const GzipCache&);
+
+	public:
+		~GzipCache(void);
+
+		static GzipCache&	instance(void);
+
+		const std::string*	lookup(const std::string& key);
+		void				store(const std::string& key, const std::string& data);
+};
+
+#endif // GZIP_CACHE_HPP
@@ -0,0 +1,33 @@
+#ifndef GZIP_STREAM_HPP
+# define GZIP_STREAM_HPP
+
+#include <string>
+#include <zlib.h>
+
+/**
+ * @class GzipStream
+ * @brief Incremental gzip encoder over zlib's deflate stream.
+ *
+ * Each write() returns the compressed bytes available so far: input is
+ * sync-flushed, so a streamed response reaches the client as it is
+ * produced instead of when the encoder's window fills. The last write
+ * finishes the stream (gzip trailer included).
+ */
+class GzipStream
+{
+	private:
+		z_stream	_zs;
+
+		GzipStream(const GzipStream&);
+		GzipStream& operator=(const GzipStream&);
+
+	public:
+		explicit GzipStream(int level);
+		~GzipStream(void);
+
+		void				write(const char* data, std::size_t length, std::string& out, bool finish);
+
+		static std::string	compress(const std::string& data, int level);
+};
+
+#endif // GZIP_STREAM_HPP
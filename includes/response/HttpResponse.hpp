@@ -3,10 +3,29 @@
 
 #include <string>
 #include <map>
+#include <vector>
+#include <sys/types.h>
 
 //webserv
 #include <response/ResponseStatus.hpp>
 
+/// @brief Piece of a body sent from a file: `head` bytes first, then `length` bytes at `offset`.
+struct FileRange
+{
+	std::string	head;   // e.g. a multipart/byteranges part header
+	off_t		offset;
+	size_t		length;
+
+	FileRange(void) : offset(0), length(0) {}
+};
+
+/// @brief Error response serialized at config load: status line and fixed headers, then the page.
+struct ErrorResponse
+{
+	std::string	head;   // status line, Server, Content-Type and Content-Length lines
+	std::string	body;
+};
+
 //Data Transfer Object
 class HttpResponse
 {
@@ -17,6 +36,10 @@ class HttpResponse
 		std::map<std::string, std::string>	_headers;
 		std::string							_body;
 		bool								_chunked; // transfer encoding
+		std::string							_rawHeaders; // pre-serialized "Name: value\r\n" lines, written after _headers
+		int									_fileFd; // body sent from this file instead of _body, -1 if none
+		std::vector<FileRange>				_fileRanges;
+		const ErrorResponse*				_errorResponse; // sent instead of status line, body and own headers, NULL if none
 
 		HttpResponse& operator=(const HttpResponse& rhs); //blocked
 		HttpResponse(const HttpResponse& rhs); //blocked
@@ -33,8 +56,14 @@ class HttpResponse
 		void	setVersion(const std::string& version);
 		void	appendBody(const std::string& body);
 		void	appendBody(char c);
+		void	setBody(const std::string& body);
 		void	addHeader(const std::string& name, const std::string& value);
+		void	removeHeader(const std::string& name);
+		void	appendRawHeaders(const std::string& lines);
 		void	setChunked(bool chunked);
+		void	setFileBody(int fd, const std::vector<FileRange>& ranges);
+		void	setErrorResponse(const ErrorResponse* page);
+		int		releaseFileBody(std::vector<FileRange>& ranges);
 		void	reset(void);
 
 		//getters
@@ -45,6 +74,9 @@ class HttpResponse
 		const std::string&			getHeader(const std::string& name) const;
 		const std::map<std::string, std::string>&	getHeaders(void) const;
 		bool						isChunked(void) const;
+		bool						hasFileBody(void) const;
+		const std::string&			getRawHeaders(void) const;
+		const ErrorResponse*		getErrorResponse(void) const;
 };
 
 #endif //HTTP_RESPONSE_HPP
\ No newline at end of file
@@ -16,16 +16,29 @@ class ResponseBuilder
 		ResponseBuilder(const ResponseBuilder& rhs); //blocked
 		ResponseBuilder& operator=(const ResponseBuilder& rhs); //blocked
 
-		static const std::string	fmtTimestamp(void);
+		static const std::string&	fmtTimestamp(void);
+		static const std::string&	statusLine(const HttpResponse& response);
+		static std::size_t			headSize(const HttpResponse& response);
+		static void					writeHead(const HttpResponse& response, std::string& out);
 		static void					setMinimumHeaders(HttpResponse& response);
 		static std::string			errorPageGenerator(ResponseStatus::code code);
-		static bool					errorPageConfig(const std::string& root, HttpResponse& res, ServerConfig const& config);
+		static const std::string	errorResponseWriter(HttpResponse& response, bool withBody);
 		static bool					shouldCloseConnection(int statusCode);
 
 	public:
 		static const std::string	responseWriter(HttpResponse& response);
+		static const std::string	headerWriter(HttpResponse& response);
+		static bool					preloadErrorPage(ResponseStatus::code code, const std::string& path,
+										ErrorResponse& page);
 		static void					build(ClientConnection& client, HttpRequest& req, HttpResponse& res);
 		static void					handleCgiOutput(HttpResponse& response, const std::string& output);
+		static std::size_t			parseCgiHeaders(HttpResponse& response, const std::string& output);
+		static bool					shouldGzip(const HttpResponse& response, const LocationConfig& location,
+										std::size_t length);
+		static void					gzipResponse(HttpResponse& response, const LocationConfig& location,
+										bool accepted);
+		static void					applyCachePolicy(HttpResponse& response, const LocationConfig& location);
+		static void					applyServerTiming(HttpResponse& response, const AccessRecord& record);
 		static void					handleStaticPageOutput(HttpResponse& response,
 										const std::string output,
 										const std::string& mimeType);
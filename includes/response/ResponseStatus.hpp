@@ -46,9 +46,11 @@ struct ResponseStatus
 		RequestTimeout = 408,
 		Conflict = 409,
 		Gone = 410,
+		PreconditionFailed = 412,
 		PayloadTooLarge = 413,
 		UriTooLong = 414,
 		UnsupportedMediaType = 415,
+		RangeNotSatisfiable = 416,
 		ExpectationFailed = 417,
 
 		/* Server Error - 5xx */
@@ -0,0 +1,136 @@
+#ifndef ACCESS_LOG_HPP
+# define ACCESS_LOG_HPP
+
+#include <string>
+#include <vector>
+#include <map>
+#include <ctime>
+#include <sys/types.h>
+
+//webserv
+#include <request/RequestPhase.hpp>
+
+/// @brief Format of `access_log` when none is given (or `main`).
+#define ACCESS_LOG_FORMAT "$remote_addr [$time_local] \"$request_method $request_uri\" $status " \
+	"$request_length $bytes_sent $upstream_response_time $request_time $connection_requests"
+
+/// @brief Variables of an `access_log` format.
+struct AccessLogVar
+{
+	enum name
+	{
+		None = 0,           ///< Literal text only.
+		RemoteAddr,         ///< $remote_addr
+		TimeLocal,          ///< $time_local, e.g. 18/Oct/2026:09:52:28 +0000
+		TimeIso8601,        ///< $time_iso8601
+		Method,             ///< $request_method
+		Uri,                ///< $request_uri
+		Status,             ///< $status
+		RequestLength,      ///< $request_length: bytes received
+		BytesSent,          ///< $bytes_sent: bytes sent, headers included
+		UpstreamTime,       ///< $upstream_response_time: CGI / FastCGI seconds, "-" if none
+		RequestTime,        ///< $request_time: seconds from the first byte to the last one sent
+		ConnectionRequests  ///< $connection_requests: requests served on the connection so far
+	};
+};
+
+/// @brief Piece of a compiled format: literal text, then a variable.
+struct AccessLogField
+{
+	std::string			literal;
+	AccessLogVar::name	var;
+
+	AccessLogField(void) : var(AccessLogVar::None) {}
+};
+
+/// @brief Settings of a server's `access_log` directive.
+struct AccessLogConfig
+{
+	std::string					path;       // empty: no access log
+	bool						json;       // one JSON object per line instead of `fields`
+	std::vector<AccessLogField>	fields;     // compiled text format
+	std::size_t					buffer;     // bytes held before a write, default 64k
+	int							flushMs;    // pending lines written at least this often, default 1s
+	std::size_t					rotateSize; // file renamed to <path>.1 past this size, 0 = never
+
+	AccessLogConfig(void);
+};
+
+/// @brief What the access log records about one request, filled in as it is served.
+struct AccessRecord
+{
+	std::string		method;     // empty until the request is dispatched
+	std::string		uri;
+	int				route;      // RouteType::route, -1 until the request is routed
+	int				status;     // 0 until the response is built (never for nph- scripts)
+	std::size_t		bytesIn;
+	std::size_t		bytesOut;
+	long			startUs;    // monotonic µs of the first byte, 0 before it
+	long			upstreamStartUs; // 0 when no backend was involved
+	long			upstreamUs; // -1 until the backend answered
+	unsigned long	requests;   // requests served on the connection, this one included
+	long			phaseEndUs[RequestPhase::Count]; // monotonic µs at which each phase ended, 0 if not reached
+
+	AccessRecord(void);
+	void	next(void);
+	void	mark(RequestPhase::phase phase);
+	long	phaseUs(RequestPhase::phase phase) const;
+	RequestPhase::phase	currentPhase(void) const;
+};
+
+/// @brief One open access log file and its pending lines.
+struct AccessLogFile
+{
+	int				fd;
+	std::string		pending;
+	std::size_t		buffer;
+	int				flushMs;
+	long			lastFlushMs;
+	std::size_t		rotateSize;
+	off_t			size;
+
+	AccessLogFile(void) : fd(-1), buffer(0), flushMs(0), lastFlushMs(0), rotateSize(0), size(0) {}
+};
+
+/**
+ * @class AccessLog
+ * @brief Per-request access log lines, buffered per file and written in batches.
+ *
+ * Lines are appended in memory; the event loop writes a file's batch with
+ * one write() once its `flush=` interval elapsed, sooner when `buffer=`
+ * fills up. A file past `rotate=` is renamed to <path>.1 and reopened;
+ * SIGUSR1 reopens every file after an external rotation.
+ */
+class AccessLog
+{
+	private:
+		std::map<std::string, AccessLogFile>	_files;
+		std::time_t								_second;
+		std::string								_timeLocal;
+		std::string								_timeIso;
+
+		AccessLog(void);
+		AccessLog(const AccessLog&);
+		AccessLog& operator=(const AccessLog&);
+
+		void	openFile(const std::string& path, AccessLogFile& file);
+		void	flushFile(const std::string& path, AccessLogFile& file, long nowMs);
+		void	format(const AccessLogConfig& config, const AccessRecord& record,
+					const std::string& remoteAddr, std::string& out);
+
+	public:
+		~AccessLog(void);
+
+		static AccessLog&	instance(void);
+		static long			clockUs(void);
+		static void			compileFormat(const std::string& format, std::vector<AccessLogField>& fields);
+
+		void				open(const AccessLogConfig& config);
+		void				write(const AccessLogConfig& config, const AccessRecord& record,
+								const std::string& remoteAddr);
+		void				tick(bool reopen);
+		int					pollTimeout(void) const;
+		void				flushAll(void);
+};
+
+#endif // ACCESS_LOG_HPP
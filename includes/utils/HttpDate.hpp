@@ -0,0 +1,32 @@
+#ifndef HTTP_DATE_HPP
+# define HTTP_DATE_HPP
+
+#include <string>
+#include <ctime>
+
+/**
+ * @class HttpDate
+ * @brief Formats and parses HTTP-date values (Date, Last-Modified, If-Modified-Since...).
+ *
+ * The current date is formatted once per second, when the event loop
+ * calls tick(), and shared by every response sent during that second.
+ */
+class HttpDate
+{
+	private:
+		static std::time_t	_tickSecond;
+		static std::string	_tickDate;
+
+		HttpDate(void); //blocked
+		~HttpDate(void); //blocked
+		HttpDate(const HttpDate& rhs); //blocked
+		HttpDate& operator=(const HttpDate& rhs); //blocked
+
+	public:
+		static std::string	format(std::time_t t);
+		static bool			parse(const std::string& value, std::time_t& out);
+		static void			tick(std::time_t now);
+		static const std::string&	current(void);
+};
+
+#endif //HTTP_DATE_HPP
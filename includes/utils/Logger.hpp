@@ -6,9 +6,7 @@
 #endif //DEV
 
 #include <ctime>
-#include <fstream>
-#include <iostream>
-#include <sstream>
+#include <string>
 
 enum LogLevel
 {
@@ -19,17 +17,47 @@ enum LogLevel
 	CRITICAL
 };
 
+/// @brief Lowest level compiled in: DEBUG in DEV builds, INFO otherwise.
+#ifndef LOG_LEVEL
+# if DEV
+#  define LOG_LEVEL DEBUG
+# else
+#  define LOG_LEVEL INFO
+# endif
+#endif //LOG_LEVEL
+
+/// @brief Logs a message unless its level is below LOG_LEVEL, in which case the message is never built.
+#define LOG(level, message) \
+	do { if ((level) >= LOG_LEVEL) Logger::instance().log((level), (message)); } while (0)
+
+/// @brief Bytes of pending entries that force a flush before the next loop tick.
+#define LOG_BUFFER_MAX (64 * 1024)
+
+/**
+ * @class Logger
+ * @brief Buffered logger: entries are appended in memory and written in batches.
+ *
+ * The event loop calls flush() once per iteration, so each batch costs one
+ * write() to the log file and one to the console. ERROR and CRITICAL entries
+ * are flushed at once, and so is a buffer past LOG_BUFFER_MAX.
+ */
 class Logger
 {
 	private:
-		std::ofstream		_logFile;
-		const std::string	levelToString(LogLevel level) const;
+		int					_fd;
+		std::string			_buffer;
+		std::time_t			_second;	// second _stamp was formatted for
+		char				_stamp[32];	// "[YYYY-MM-DD HH:MM:SS] "
+
 		Logger();
+		Logger(const Logger&);
+		Logger& operator=(const Logger&);
 
 	public:
 		~Logger();
 		static Logger&	instance();
 		void			log(LogLevel level, const std::string& message);
+		void			flush(void);
 };
 
-#endif //LOGGER_HPP
\ No newline at end of file
+#endif //LOGGER_HPP
@@ -0,0 +1,127 @@
+#ifndef METRICS_HPP
+# define METRICS_HPP
+
+#include <string>
+#include <map>
+
+//webserv
+#include <dispatcher/RouteType.hpp>
+#include <request/RequestPhase.hpp>
+#include <utils/AccessLog.hpp>
+
+/// @brief Sub-buckets per power of two, as a bit count: 4 sub-buckets, at most 25% relative error.
+#define HISTOGRAM_SUB_BITS 2
+/// @brief Values recorded exactly up to 2^HISTOGRAM_MAGNITUDES µs (~134 s); longer ones share the last bucket.
+#define HISTOGRAM_MAGNITUDES 27
+/// @brief Number of buckets of a Histogram.
+#define HISTOGRAM_BUCKETS ((HISTOGRAM_MAGNITUDES - HISTOGRAM_SUB_BITS + 1) << HISTOGRAM_SUB_BITS)
+/// @brief Seconds between two logs of the request phase and event loop timings.
+#define TIMING_LOG_INTERVAL 60
+/// @brief Processing time (ms) of one event loop iteration past which the watchdog logs a diagnostic.
+#ifndef LOOP_STALL_MS
+# define LOOP_STALL_MS 100
+#endif
+
+class ClientConnection;
+
+/**
+ * @class Histogram
+ * @brief Log-linear (HDR-style) histogram of durations in microseconds (or of any count).
+ *
+ * Each power of two is split into 2^HISTOGRAM_SUB_BITS equal buckets, so
+ * recording is one bit scan and one increment, memory is fixed and the
+ * precision of percentiles is relative to the value.
+ */
+class Histogram
+{
+	private:
+		unsigned long		_buckets[HISTOGRAM_BUCKETS];
+		unsigned long		_count;
+		unsigned long long	_sumUs;
+		long				_maxUs;
+
+	public:
+		Histogram(void);
+
+		void				record(long us);
+		void				reset(void);
+		unsigned long		count(void) const;
+		unsigned long long	sumUs(void) const;
+		long				maxUs(void) const;
+		unsigned long		countBelow(long us) const;
+		long				percentile(double p) const;
+
+		static std::size_t	bucketOf(long us);
+		static long			bucketUpper(std::size_t index);
+};
+
+/// @brief Requests served and their latency, for one RouteType.
+struct RouteMetrics
+{
+	unsigned long	requests;
+	Histogram		latency; // first byte received to last byte sent
+
+	RouteMetrics(void) : requests(0) {}
+};
+
+/**
+ * @class Metrics
+ * @brief Process-wide counters, exposed as Prometheus text by `stub_status`.
+ *
+ * Counters are plain integers updated from the single-threaded event loop;
+ * connection states are counted only when the endpoint is scraped. Request
+ * phase durations and event loop iterations are also aggregated per window
+ * and logged every TIMING_LOG_INTERVAL seconds, then cleared.
+ */
+class Metrics
+{
+	private:
+		unsigned long							_accepts;
+		unsigned long							_requests;
+		unsigned long							_statusClass[6]; // index status / 100, 0 unused
+		unsigned long long						_bytesSent;
+		unsigned long							_cgiSpawns;
+		unsigned long							_cgiExits;
+		unsigned long							_cgiTimeouts;
+		RouteMetrics							_routes[RouteType::Count];
+		Histogram								_phases[RequestPhase::Count]; // since the last timing log
+		long									_phasesSinceUs;
+		unsigned long							_loopIterations;
+		unsigned long long						_loopPollUs;   // waiting in poll()
+		unsigned long long						_loopBusyUs;   // processing after poll() returned
+		unsigned long							_loopStalls;   // iterations busy for LOOP_STALL_MS or more
+		Histogram								_loopBusy;     // since the last timing log
+		Histogram								_loopReady;    // descriptors ready per poll(), since the last timing log
+		unsigned long long						_loopWindowPollUs;
+		long									_handlerMaxUs; // longest single handler call since startup
+		std::string								_handlerMax;   // what it was handling
+		std::map<int, ClientConnection> const*	_clients;
+
+		Metrics(void);
+		Metrics(const Metrics&);
+		Metrics& operator=(const Metrics&);
+
+	public:
+		~Metrics(void);
+
+		static Metrics&		instance(void);
+		static const char*	routeName(RouteType::route route);
+		static const char*	phaseName(RequestPhase::phase phase);
+
+		void				watchClients(std::map<int, ClientConnection> const* clients);
+		void				onAccept(void);
+		void				onRequest(RouteType::route route);
+		void				onResponse(const AccessRecord& record, long totalUs);
+		void				onCgiSpawn(void);
+		void				onCgiExit(void);
+		void				onCgiTimeout(void);
+		void				onIteration(long pollUs, long busyUs, int ready);
+		void				onStall(void);
+		long				handlerMaxUs(void) const;
+		void				setHandlerMax(long us, const std::string& what);
+
+		void				tick(long nowUs);
+		void				render(std::string& out) const;
+};
+
+#endif // METRICS_HPP
@@ -3,13 +3,13 @@
 
 #include <csignal>
 #include <ctime>
-#include <map>
 #include <unistd.h>
 
 class Signals
 {
 	private:
 		static volatile std::sig_atomic_t	g_shouldStop;
+		static volatile std::sig_atomic_t	g_reopenLogs;
 		
 	public:
 		Signals(void);
@@ -17,15 +17,12 @@ class Signals
 		static const int					CGI_TIMEOUT_SEC = 30;
 		
 		static void	signalHandle(int signal);
-		static void	childSignalHandle(int signal);
+		static void	reopenHandle(int signal);
 
 		static bool	shouldStop(void);
+		static int	stopSignal(void);
+		static bool	takeLogReopen(void);
 		static void	setupHandlers(void);
-
-		static void	registerCgiProcess(pid_t pid);
-		static void	unregisterCgiProcess(pid_t pid);
-		static bool	hasActiveCgi(void);
-		static void	checkCgiTimeouts(void);
 };
 
 #endif
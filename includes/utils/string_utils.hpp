@@ -116,6 +116,20 @@ inline std::string toString(T value)
 	return oss.str();
 }
 
+/// @brief Formats an unsigned size in decimal without going through a stream (Content-Length...).
+inline std::string sizeToString(std::size_t value)
+{
+	char buf[24];
+	char* p = buf + sizeof(buf);
+
+	do
+	{
+		*--p = static_cast<char>('0' + value % 10);
+		value /= 10;
+	} while (value);
+	return std::string(p, buf + sizeof(buf) - p);
+}
+
 /// @brief Checks whether a string starts with a given prefix.
 inline bool startsWith(const std::string& s, const std::string& prefix)
 {